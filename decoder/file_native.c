@@ -0,0 +1,119 @@
+#ifndef _WIN32
+// Keep off_t 64-bit on 32-bit platforms so offsets past 2 GB work.
+#define _FILE_OFFSET_BITS 64
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "moonbit.h"
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// `path` is NUL-terminated UTF-8. Returns a descriptor, or -1.
+int32_t moon_rodio_file_open(uint8_t *path) {
+  if (path == NULL) {
+    return -1;
+  }
+#ifdef _WIN32
+  int wide_len = MultiByteToWideChar(CP_UTF8, 0, (const char *)path, -1, NULL, 0);
+  if (wide_len <= 0) {
+    return -1;
+  }
+  wchar_t *wide = (wchar_t *)malloc((size_t)wide_len * sizeof(wchar_t));
+  if (wide == NULL) {
+    return -1;
+  }
+  MultiByteToWideChar(CP_UTF8, 0, (const char *)path, -1, wide, wide_len);
+  int fd = _wopen(wide, _O_RDONLY | _O_BINARY);
+  free(wide);
+  return fd;
+#else
+  int fd;
+  do {
+    fd = open((const char *)path, O_RDONLY | O_CLOEXEC);
+  } while (fd < 0 && errno == EINTR);
+  return fd;
+#endif
+}
+
+// Size of the file in bytes, or -1.
+int64_t moon_rodio_file_size(int32_t fd) {
+#ifdef _WIN32
+  struct _stat64 st;
+  if (_fstat64(fd, &st) != 0) {
+    return -1;
+  }
+  return (int64_t)st.st_size;
+#else
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    return -1;
+  }
+  return (int64_t)st.st_size;
+#endif
+}
+
+// Reads up to `len` bytes at absolute file offset `pos` into
+// `buf[offset..offset + len]`. Short reads only happen at end of file.
+// Returns the number of bytes read, or -1.
+int32_t moon_rodio_file_read_at(int32_t fd,
+                                uint8_t *buf,
+                                int32_t offset,
+                                int32_t len,
+                                int64_t pos) {
+  if (buf == NULL || offset < 0 || len < 0 || pos < 0) {
+    return -1;
+  }
+  int32_t total = 0;
+#ifdef _WIN32
+  if (_lseeki64(fd, pos, SEEK_SET) < 0) {
+    return -1;
+  }
+  while (total < len) {
+    int n = _read(fd, buf + offset + total, (unsigned int)(len - total));
+    if (n < 0) {
+      return -1;
+    }
+    if (n == 0) {
+      break;
+    }
+    total += n;
+  }
+#else
+  while (total < len) {
+    ssize_t n = pread(fd, buf + offset + total, (size_t)(len - total),
+                      (off_t)(pos + total));
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    if (n == 0) {
+      break;
+    }
+    total += (int32_t)n;
+  }
+#endif
+  return total;
+}
+
+int32_t moon_rodio_file_close(int32_t fd) {
+#ifdef _WIN32
+  return _close(fd);
+#else
+  return close(fd);
+#endif
+}